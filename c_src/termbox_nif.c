@@ -183,6 +183,17 @@ static ERL_NIF_TERM nif_init_rwfd(ErlNifEnv *env, int argc, const ERL_NIF_TERM a
   return ok_or_err(env, tb_init_rwfd(rfd, wfd));
 }
 
+static ERL_NIF_TERM nif_preload_term(ErlNifEnv *env, int argc, const ERL_NIF_TERM argv[]) {
+  (void)argc;
+  char *term = NULL;
+  if (!term_to_c_string(env, argv[0], &term)) {
+    return enif_make_badarg(env);
+  }
+  int rv = tb_preload_term(term);
+  enif_free(term);
+  return ok_or_err(env, rv);
+}
+
 static ERL_NIF_TERM nif_shutdown(ErlNifEnv *env, int argc, const ERL_NIF_TERM argv[]) {
   (void)argc; (void)argv;
   return ok_or_err(env, tb_shutdown());
@@ -250,6 +261,53 @@ static ERL_NIF_TERM nif_set_cell(ErlNifEnv *env, int argc, const ERL_NIF_TERM ar
   return ok_or_err(env, tb_set_cell(x, y, (uint32_t)ch, fg, bg));
 }
 
+// Cells written by set_cells between checks of the scheduler timeslice
+#define SET_CELLS_CHUNK 1024
+#define SET_CELLS_CHUNK_PERCENT 10
+
+static ERL_NIF_TERM set_cells_one(ErlNifEnv *env, ERL_NIF_TERM cell) {
+  int arity;
+  const ERL_NIF_TERM *elems;
+  int x, y;
+  unsigned int ch;
+  uintattr_t fg, bg;
+  if (!enif_get_tuple(env, cell, &arity, &elems) || arity != 5 ||
+      !enif_get_int(env, elems[0], &x) || !enif_get_int(env, elems[1], &y) ||
+      !enif_get_uint(env, elems[2], &ch) ||
+      !term_to_uintattr(env, elems[3], &fg) ||
+      !term_to_uintattr(env, elems[4], &bg)) {
+    return enif_make_badarg(env);
+  }
+  int rv = tb_set_cell(x, y, (uint32_t)ch, fg, bg);
+  if (rv < 0) {
+    return make_error(env, rv);
+  }
+  return atom_ok;
+}
+
+static ERL_NIF_TERM nif_set_cells(ErlNifEnv *env, int argc, const ERL_NIF_TERM argv[]) {
+  ERL_NIF_TERM head, tail = argv[0];
+  int n = 0;
+  if (!enif_is_list(env, tail)) {
+    return enif_make_badarg(env);
+  }
+  while (enif_get_list_cell(env, tail, &head, &tail)) {
+    ERL_NIF_TERM rv = set_cells_one(env, head);
+    if (rv != atom_ok) {
+      return rv;
+    }
+    if (++n < SET_CELLS_CHUNK) {
+      continue;
+    }
+    n = 0;
+    // Yield once the timeslice is used up and continue with the rest of the list
+    if (enif_consume_timeslice(env, SET_CELLS_CHUNK_PERCENT) && !enif_is_empty_list(env, tail)) {
+      return enif_schedule_nif(env, "set_cells", 0, nif_set_cells, argc, &tail);
+    }
+  }
+  return atom_ok;
+}
+
 static ERL_NIF_TERM nif_set_cell_ex(ErlNifEnv *env, int argc, const ERL_NIF_TERM argv[]) {
   (void)argc;
   int x, y;
@@ -629,6 +687,403 @@ static ERL_NIF_TERM nif_wcwidth(ErlNifEnv *env, int argc, const ERL_NIF_TERM arg
   return enif_make_int(env, tb_wcwidth((uint32_t)ch_val));
 }
 
+/*
+ * Pixel canvas
+ *
+ * A pixel canvas is a NIF resource holding a grid of sub-cell pixels that is
+ * rasterized into the Termbox2 back buffer in a single call. Braille mode packs
+ * 2x4 pixels into one cell (U+2800..U+28FF); half-block mode packs 1x2 pixels
+ * into one cell using U+2580/U+2584 with the lower pixel carried in the
+ * background attribute. Every pixel stores its own foreground attribute, so a
+ * series or heatmap can be uploaded and drawn without per-cell round trips.
+ */
+
+#define PIXEL_CANVAS_BRAILLE    0
+#define PIXEL_CANVAS_HALF_BLOCK 1
+
+// Larger than any real terminal; `draw` clips to the terminal anyway
+#define PIXEL_CANVAS_MAX_CELLS 1024
+#define PIXEL_CANVAS_MAX_COORD 65536
+
+#define PIXEL_SERIES_POINTS 0
+#define PIXEL_SERIES_LINE   1
+#define PIXEL_SERIES_AREA   2
+
+struct pixel_canvas {
+  int mode;
+  int cols;
+  int rows;
+  int width;
+  int height;
+  uint8_t *lit;
+  uintattr_t *color;
+  ErlNifRWLock *lock;
+};
+
+static ErlNifResourceType *pixel_canvas_type;
+
+static const uint8_t braille_bits[4][2] = {
+  {0x01, 0x08},
+  {0x02, 0x10},
+  {0x04, 0x20},
+  {0x40, 0x80}
+};
+
+static void pixel_canvas_dtor(ErlNifEnv *env, void *obj) {
+  (void)env;
+  struct pixel_canvas *canvas = obj;
+  if (canvas->lit) enif_free(canvas->lit);
+  if (canvas->color) enif_free(canvas->color);
+  if (canvas->lock) enif_rwlock_destroy(canvas->lock);
+}
+
+static int get_pixel_canvas(ErlNifEnv *env, ERL_NIF_TERM term, struct pixel_canvas **out) {
+  return enif_get_resource(env, term, pixel_canvas_type, (void **)out);
+}
+
+/*
+ * Bulk operations run on dirty schedulers and may hold the canvas lock for a
+ * while. Calls running on a normal scheduler only try the lock; on contention
+ * they return 0 and the caller reschedules itself as dirty work, where
+ * blocking is fine.
+ */
+static int pixel_canvas_lock(struct pixel_canvas *canvas, int write) {
+  if (enif_thread_type() == ERL_NIF_THR_NORMAL_SCHEDULER) {
+    int busy = write ? enif_rwlock_tryrwlock(canvas->lock) : enif_rwlock_tryrlock(canvas->lock);
+    return busy == 0;
+  }
+  if (write) {
+    enif_rwlock_rwlock(canvas->lock);
+  } else {
+    enif_rwlock_rlock(canvas->lock);
+  }
+  return 1;
+}
+
+static inline int pixel_coord_ok(int v) {
+  return v >= -PIXEL_CANVAS_MAX_COORD && v <= PIXEL_CANVAS_MAX_COORD;
+}
+
+static inline void pixel_canvas_plot(struct pixel_canvas *canvas, int x, int y, uintattr_t color) {
+  if (x < 0 || y < 0 || x >= canvas->width || y >= canvas->height) {
+    return;
+  }
+  size_t i = (size_t)y * (size_t)canvas->width + (size_t)x;
+  canvas->lit[i] = 1;
+  canvas->color[i] = color;
+}
+
+static void pixel_canvas_line(struct pixel_canvas *canvas, int x0, int y0, int x1, int y1,
+                              uintattr_t color) {
+  int dx = x1 > x0 ? x1 - x0 : x0 - x1;
+  int dy = y1 > y0 ? y0 - y1 : y1 - y0;
+  int sx = x0 < x1 ? 1 : -1;
+  int sy = y0 < y1 ? 1 : -1;
+  int err = dx + dy;
+  for (;;) {
+    pixel_canvas_plot(canvas, x0, y0, color);
+    if (x0 == x1 && y0 == y1) {
+      break;
+    }
+    int e2 = 2 * err;
+    if (e2 >= dy) {
+      err += dy;
+      x0 += sx;
+    }
+    if (e2 <= dx) {
+      err += dx;
+      y0 += sy;
+    }
+  }
+}
+
+static void pixel_canvas_column(struct pixel_canvas *canvas, int x, int y, uintattr_t color) {
+  if (x < 0 || x >= canvas->width) {
+    return;
+  }
+  for (int row = y < 0 ? 0 : y; row < canvas->height; row++) {
+    pixel_canvas_plot(canvas, x, row, color);
+  }
+}
+
+static void pixel_canvas_area(struct pixel_canvas *canvas, int x0, int y0, int x1, int y1,
+                              uintattr_t color) {
+  if (x0 > x1) {
+    int tx = x0, ty = y0;
+    x0 = x1; y0 = y1;
+    x1 = tx; y1 = ty;
+  }
+  if (x0 == x1) {
+    pixel_canvas_column(canvas, x0, y0 < y1 ? y0 : y1, color);
+    return;
+  }
+  for (int x = x0; x <= x1; x++) {
+    int y = y0 + (int)(((long long)(y1 - y0) * (x - x0)) / (x1 - x0));
+    pixel_canvas_column(canvas, x, y, color);
+  }
+}
+
+static int series_value_to_y(const struct pixel_canvas *canvas, double v, double lo, double hi) {
+  // A flat range has no scale; draw it across the middle
+  double t = (hi > lo) ? (v - lo) / (hi - lo) : 0.5;
+  if (t < 0.0) t = 0.0;
+  if (t > 1.0) t = 1.0;
+  return (canvas->height - 1) - (int)(t * (canvas->height - 1) + 0.5);
+}
+
+static int term_to_double(ErlNifEnv *env, ERL_NIF_TERM term, double *out) {
+  if (enif_get_double(env, term, out)) {
+    return 1;
+  }
+  ErlNifSInt64 tmp;
+  if (enif_get_int64(env, term, &tmp)) {
+    *out = (double)tmp;
+    return 1;
+  }
+  return 0;
+}
+
+static ERL_NIF_TERM nif_pixel_canvas_new(ErlNifEnv *env, int argc, const ERL_NIF_TERM argv[]) {
+  (void)argc;
+  int cols, rows, mode;
+  if (!enif_get_int(env, argv[0], &cols) || !enif_get_int(env, argv[1], &rows) ||
+      !enif_get_int(env, argv[2], &mode)) {
+    return enif_make_badarg(env);
+  }
+  if (cols <= 0 || rows <= 0 || cols > PIXEL_CANVAS_MAX_CELLS || rows > PIXEL_CANVAS_MAX_CELLS ||
+      (mode != PIXEL_CANVAS_BRAILLE && mode != PIXEL_CANVAS_HALF_BLOCK)) {
+    return enif_make_badarg(env);
+  }
+  struct pixel_canvas *canvas = enif_alloc_resource(pixel_canvas_type, sizeof(*canvas));
+  if (canvas == NULL) {
+    return make_error(env, TB_ERR_MEM);
+  }
+  canvas->mode = mode;
+  canvas->cols = cols;
+  canvas->rows = rows;
+  canvas->width = (mode == PIXEL_CANVAS_BRAILLE) ? cols * 2 : cols;
+  canvas->height = (mode == PIXEL_CANVAS_BRAILLE) ? rows * 4 : rows * 2;
+  size_t count = (size_t)canvas->width * (size_t)canvas->height;
+  canvas->lit = enif_alloc(count);
+  canvas->color = enif_alloc(count * sizeof(uintattr_t));
+  canvas->lock = enif_rwlock_create("pixel_canvas");
+  if (canvas->lit == NULL || canvas->color == NULL || canvas->lock == NULL) {
+    enif_release_resource(canvas);
+    return make_error(env, TB_ERR_MEM);
+  }
+  memset(canvas->lit, 0, count);
+  memset(canvas->color, 0, count * sizeof(uintattr_t));
+  ERL_NIF_TERM term = enif_make_resource(env, canvas);
+  enif_release_resource(canvas);
+  return make_ok_value(env, term);
+}
+
+static ERL_NIF_TERM nif_pixel_canvas_clear(ErlNifEnv *env, int argc, const ERL_NIF_TERM argv[]) {
+  struct pixel_canvas *canvas;
+  if (!get_pixel_canvas(env, argv[0], &canvas)) {
+    return enif_make_badarg(env);
+  }
+  if (!pixel_canvas_lock(canvas, 1)) {
+    return enif_schedule_nif(env, "pixel_canvas_clear", ERL_NIF_DIRTY_JOB_CPU_BOUND,
+                             nif_pixel_canvas_clear, argc, argv);
+  }
+  memset(canvas->lit, 0, (size_t)canvas->width * (size_t)canvas->height);
+  enif_rwlock_rwunlock(canvas->lock);
+  return atom_ok;
+}
+
+static ERL_NIF_TERM nif_pixel_canvas_set(ErlNifEnv *env, int argc, const ERL_NIF_TERM argv[]) {
+  struct pixel_canvas *canvas;
+  int x, y;
+  uintattr_t color;
+  if (!get_pixel_canvas(env, argv[0], &canvas) ||
+      !enif_get_int(env, argv[1], &x) || !enif_get_int(env, argv[2], &y) ||
+      !term_to_uintattr(env, argv[3], &color)) {
+    return enif_make_badarg(env);
+  }
+  if (!pixel_canvas_lock(canvas, 1)) {
+    return enif_schedule_nif(env, "pixel_canvas_set", ERL_NIF_DIRTY_JOB_CPU_BOUND,
+                             nif_pixel_canvas_set, argc, argv);
+  }
+  pixel_canvas_plot(canvas, x, y, color);
+  enif_rwlock_rwunlock(canvas->lock);
+  return atom_ok;
+}
+
+static ERL_NIF_TERM nif_pixel_canvas_line(ErlNifEnv *env, int argc, const ERL_NIF_TERM argv[]) {
+  struct pixel_canvas *canvas;
+  int x0, y0, x1, y1;
+  uintattr_t color;
+  if (!get_pixel_canvas(env, argv[0], &canvas) ||
+      !enif_get_int(env, argv[1], &x0) || !enif_get_int(env, argv[2], &y0) ||
+      !enif_get_int(env, argv[3], &x1) || !enif_get_int(env, argv[4], &y1) ||
+      !term_to_uintattr(env, argv[5], &color)) {
+    return enif_make_badarg(env);
+  }
+  if (!pixel_coord_ok(x0) || !pixel_coord_ok(y0) || !pixel_coord_ok(x1) || !pixel_coord_ok(y1)) {
+    return enif_make_badarg(env);
+  }
+  if (!pixel_canvas_lock(canvas, 1)) {
+    return enif_schedule_nif(env, "pixel_canvas_line", ERL_NIF_DIRTY_JOB_CPU_BOUND,
+                             nif_pixel_canvas_line, argc, argv);
+  }
+  pixel_canvas_line(canvas, x0, y0, x1, y1, color);
+  enif_rwlock_rwunlock(canvas->lock);
+  return atom_ok;
+}
+
+static ERL_NIF_TERM nif_pixel_canvas_fill(ErlNifEnv *env, int argc, const ERL_NIF_TERM argv[]) {
+  (void)argc;
+  struct pixel_canvas *canvas;
+  int x, y, w, h;
+  uintattr_t color;
+  if (!get_pixel_canvas(env, argv[0], &canvas) ||
+      !enif_get_int(env, argv[1], &x) || !enif_get_int(env, argv[2], &y) ||
+      !enif_get_int(env, argv[3], &w) || !enif_get_int(env, argv[4], &h) ||
+      !term_to_uintattr(env, argv[5], &color)) {
+    return enif_make_badarg(env);
+  }
+  // Clip in 64-bit so extreme coordinates cannot overflow
+  long long x_end = (long long)x + w;
+  long long y_end = (long long)y + h;
+  if (x_end > canvas->width) x_end = canvas->width;
+  if (y_end > canvas->height) y_end = canvas->height;
+  int x_start = x < 0 ? 0 : x;
+  int y_start = y < 0 ? 0 : y;
+  enif_rwlock_rwlock(canvas->lock);
+  for (int row = y_start; row < y_end; row++) {
+    for (int col = x_start; col < x_end; col++) {
+      pixel_canvas_plot(canvas, col, row, color);
+    }
+  }
+  enif_rwlock_rwunlock(canvas->lock);
+  return atom_ok;
+}
+
+static ERL_NIF_TERM nif_pixel_canvas_series(ErlNifEnv *env, int argc, const ERL_NIF_TERM argv[]) {
+  (void)argc;
+  struct pixel_canvas *canvas;
+  unsigned int len;
+  double lo, hi;
+  uintattr_t color;
+  int style;
+  if (!get_pixel_canvas(env, argv[0], &canvas) ||
+      !enif_get_list_length(env, argv[1], &len) ||
+      !term_to_double(env, argv[2], &lo) || !term_to_double(env, argv[3], &hi) ||
+      !term_to_uintattr(env, argv[4], &color) || !enif_get_int(env, argv[5], &style) ||
+      style < PIXEL_SERIES_POINTS || style > PIXEL_SERIES_AREA) {
+    return enif_make_badarg(env);
+  }
+  ERL_NIF_TERM head, tail = argv[1];
+  int prev_x = 0, prev_y = 0;
+  int span = canvas->width - 1;
+  enif_rwlock_rwlock(canvas->lock);
+  for (unsigned int i = 0; i < len; i++) {
+    double v;
+    if (!enif_get_list_cell(env, tail, &head, &tail) || !term_to_double(env, head, &v)) {
+      enif_rwlock_rwunlock(canvas->lock);
+      return enif_make_badarg(env);
+    }
+    int x = (len > 1) ? (int)(((unsigned long long)i * (unsigned long long)span) / (len - 1)) : 0;
+    int y = series_value_to_y(canvas, v, lo, hi);
+    if (style == PIXEL_SERIES_POINTS || i == 0) {
+      if (style == PIXEL_SERIES_AREA) {
+        pixel_canvas_column(canvas, x, y, color);
+      } else {
+        pixel_canvas_plot(canvas, x, y, color);
+      }
+    } else if (style == PIXEL_SERIES_LINE) {
+      pixel_canvas_line(canvas, prev_x, prev_y, x, y, color);
+    } else {
+      pixel_canvas_area(canvas, prev_x, prev_y, x, y, color);
+    }
+    prev_x = x;
+    prev_y = y;
+  }
+  enif_rwlock_rwunlock(canvas->lock);
+  return atom_ok;
+}
+
+static void pixel_canvas_cell(const struct pixel_canvas *canvas, int col, int row, uintattr_t bg,
+                              uint32_t *ch, uintattr_t *fg_out, uintattr_t *bg_out) {
+  *fg_out = 0;
+  *bg_out = bg;
+  if (canvas->mode == PIXEL_CANVAS_HALF_BLOCK) {
+    size_t top = (size_t)(row * 2) * (size_t)canvas->width + (size_t)col;
+    size_t bottom = top + (size_t)canvas->width;
+    if (canvas->lit[top]) {
+      *ch = 0x2580;
+      *fg_out = canvas->color[top];
+      if (canvas->lit[bottom]) {
+        *bg_out = canvas->color[bottom];
+      }
+    } else if (canvas->lit[bottom]) {
+      *ch = 0x2584;
+      *fg_out = canvas->color[bottom];
+    } else {
+      *ch = ' ';
+    }
+    return;
+  }
+  uint8_t bits = 0;
+  int have_fg = 0;
+  for (int dy = 0; dy < 4; dy++) {
+    size_t base = (size_t)(row * 4 + dy) * (size_t)canvas->width + (size_t)(col * 2);
+    for (int dx = 0; dx < 2; dx++) {
+      if (canvas->lit[base + dx]) {
+        bits |= braille_bits[dy][dx];
+        if (!have_fg) {
+          *fg_out = canvas->color[base + dx];
+          have_fg = 1;
+        }
+      }
+    }
+  }
+  *ch = bits ? 0x2800 + bits : ' ';
+}
+
+static ERL_NIF_TERM nif_pixel_canvas_draw(ErlNifEnv *env, int argc, const ERL_NIF_TERM argv[]) {
+  struct pixel_canvas *canvas;
+  int x, y;
+  uintattr_t bg;
+  if (!get_pixel_canvas(env, argv[0], &canvas) ||
+      !enif_get_int(env, argv[1], &x) || !enif_get_int(env, argv[2], &y) ||
+      !term_to_uintattr(env, argv[3], &bg)) {
+    return enif_make_badarg(env);
+  }
+  int width = tb_width();
+  int height = tb_height();
+  if (width < 0 || height < 0) {
+    return make_error(env, TB_ERR_NOT_INIT);
+  }
+  if (!pixel_canvas_lock(canvas, 0)) {
+    return enif_schedule_nif(env, "pixel_canvas_draw", ERL_NIF_DIRTY_JOB_CPU_BOUND,
+                             nif_pixel_canvas_draw, argc, argv);
+  }
+  for (int row = 0; row < canvas->rows; row++) {
+    int ty = y + row;
+    if (ty < 0 || ty >= height) {
+      continue;
+    }
+    for (int col = 0; col < canvas->cols; col++) {
+      int tx = x + col;
+      if (tx < 0 || tx >= width) {
+        continue;
+      }
+      uint32_t ch;
+      uintattr_t cell_fg, cell_bg;
+      pixel_canvas_cell(canvas, col, row, bg, &ch, &cell_fg, &cell_bg);
+      int rv = tb_set_cell(tx, ty, ch, cell_fg, cell_bg);
+      if (rv < 0) {
+        enif_rwlock_runlock(canvas->lock);
+        return make_error(env, rv);
+      }
+    }
+  }
+  enif_rwlock_runlock(canvas->lock);
+  return atom_ok;
+}
+
 static int load(ErlNifEnv *env, void **priv, ERL_NIF_TERM info) {
   (void)priv; (void)info;
   atom_ok         = enif_make_atom(env, "ok");
@@ -661,6 +1116,19 @@ static int load(ErlNifEnv *env, void **priv, ERL_NIF_TERM info) {
   atom_nil        = enif_make_atom(env, "nil");
   atom_true       = enif_make_atom(env, "true");
   atom_false      = enif_make_atom(env, "false");
+
+  pixel_canvas_type = enif_open_resource_type(env, NULL, "pixel_canvas", pixel_canvas_dtor,
+                                              ERL_NIF_RT_CREATE | ERL_NIF_RT_TAKEOVER, NULL);
+  if (pixel_canvas_type == NULL) {
+    return -1;
+  }
+
+  // Warm the terminfo cache so session init skips the filesystem search.
+  // Failure is not fatal; init will report it for the session that needs it.
+  const char *term = getenv("TERM");
+  if (term != NULL) {
+    tb_preload_term(term);
+  }
   return 0;
 }
 
@@ -669,6 +1137,7 @@ static ErlNifFunc nif_funcs[] = {
   {"init_file",         1, nif_init_file,          0},
   {"init_fd",           1, nif_init_fd,            0},
   {"init_rwfd",         2, nif_init_rwfd,          0},
+  {"preload_term",      1, nif_preload_term, ERL_NIF_DIRTY_JOB_IO_BOUND},
   {"shutdown",          0, nif_shutdown,           0},
   {"width",             0, nif_width,              0},
   {"height",            0, nif_height,             0},
@@ -679,6 +1148,7 @@ static ErlNifFunc nif_funcs[] = {
   {"set_cursor",        2, nif_set_cursor,         0},
   {"hide_cursor",       0, nif_hide_cursor,        0},
   {"set_cell",          5, nif_set_cell,           0},
+  {"set_cells",         1, nif_set_cells,          0},
   {"set_cell_ex",       5, nif_set_cell_ex,        0},
   {"extend_cell",       3, nif_extend_cell,        0},
   {"get_cell",          3, nif_get_cell,           0},
@@ -705,7 +1175,14 @@ static ErlNifFunc nif_funcs[] = {
   {"attr_width",        0, nif_attr_width,         0},
   {"version",           0, nif_version,            0},
   {"iswprint",          1, nif_iswprint,           0},
-  {"wcwidth",           1, nif_wcwidth,            0}
+  {"wcwidth",           1, nif_wcwidth,            0},
+  {"pixel_canvas_new",    3, nif_pixel_canvas_new,    ERL_NIF_DIRTY_JOB_CPU_BOUND},
+  {"pixel_canvas_clear",  1, nif_pixel_canvas_clear,  0},
+  {"pixel_canvas_set",    4, nif_pixel_canvas_set,    0},
+  {"pixel_canvas_line",   6, nif_pixel_canvas_line,   0},
+  {"pixel_canvas_fill",   6, nif_pixel_canvas_fill,   ERL_NIF_DIRTY_JOB_CPU_BOUND},
+  {"pixel_canvas_series", 6, nif_pixel_canvas_series, ERL_NIF_DIRTY_JOB_CPU_BOUND},
+  {"pixel_canvas_draw",   4, nif_pixel_canvas_draw,   0}
 };
 
 ERL_NIF_INIT(Elixir.Termbox2.Native, nif_funcs, load, NULL, NULL, NULL)
@@ -70,6 +70,9 @@ defmodule Termbox2.Native do
   @typedoc "Union of possible event payloads produced by `peek_event/1` and `poll_event/0`."
   @type event :: key_event() | mouse_event() | resize_event() | map()
 
+  @typedoc "Opaque reference to a native pixel canvas created by `pixel_canvas_new/3`."
+  @type pixel_canvas :: reference()
+
   @typedoc "Return value of `get_fds/0`."
   @type fds :: %{required(:ttyfd) => integer(), required(:resizefd) => integer()}
 
@@ -129,6 +132,15 @@ defmodule Termbox2.Native do
   @spec init_rwfd(integer(), integer()) :: result()
   def init_rwfd(_rfd, _wfd), do: :erlang.nif_error(:nif_not_loaded)
 
+  @doc """
+  Loads and caches the capabilities for a `TERM` value (`tb_preload_term`).
+
+  Sessions initialized with a cached `TERM` skip the terminfo search and parse.
+  The value of `TERM` at NIF load time is cached automatically.
+  """
+  @spec preload_term(binary() | iodata()) :: result()
+  def preload_term(_term), do: :erlang.nif_error(:nif_not_loaded)
+
   @doc """
   Shuts down Termbox2 (`tb_shutdown`).
   """
@@ -191,6 +203,15 @@ defmodule Termbox2.Native do
   @spec set_cell(coord(), coord(), non_neg_integer(), attr(), attr()) :: result()
   def set_cell(_x, _y, _ch, _fg, _bg), do: :erlang.nif_error(:nif_not_loaded)
 
+  @doc """
+  Writes a batch of `{x, y, ch, fg, bg}` cells to the back buffer in one call.
+
+  Stops at the first cell `tb_set_cell` rejects and returns its error; cells
+  before it have already been written.
+  """
+  @spec set_cells([{coord(), coord(), non_neg_integer(), attr(), attr()}]) :: result()
+  def set_cells(_cells), do: :erlang.nif_error(:nif_not_loaded)
+
   @doc """
   Writes a grapheme cluster to the back buffer (`tb_set_cell_ex`).
 
@@ -392,4 +413,58 @@ defmodule Termbox2.Native do
   """
   @spec wcwidth(non_neg_integer()) :: integer()
   def wcwidth(_codepoint), do: :erlang.nif_error(:nif_not_loaded)
+
+  @doc """
+  Allocates a pixel canvas covering `cols` x `rows` cells.
+
+  `cols` and `rows` must be between 1 and 1024. `mode` is `0` for braille
+  (2x4 pixels per cell) or `1` for half-block (1x2 pixels per cell). See
+  `Termbox2.PixelCanvas` for a friendlier wrapper.
+  """
+  @spec pixel_canvas_new(pos_integer(), pos_integer(), 0 | 1) :: result(pixel_canvas())
+  def pixel_canvas_new(_cols, _rows, _mode), do: :erlang.nif_error(:nif_not_loaded)
+
+  @doc """
+  Turns off every pixel in the canvas.
+  """
+  @spec pixel_canvas_clear(pixel_canvas()) :: :ok
+  def pixel_canvas_clear(_canvas), do: :erlang.nif_error(:nif_not_loaded)
+
+  @doc """
+  Lights the pixel at `{x, y}` with the given foreground attribute. Out-of-bounds pixels are ignored.
+  """
+  @spec pixel_canvas_set(pixel_canvas(), coord(), coord(), attr()) :: :ok
+  def pixel_canvas_set(_canvas, _x, _y, _color), do: :erlang.nif_error(:nif_not_loaded)
+
+  @doc """
+  Draws a line between two pixel coordinates, clipped to the canvas.
+  """
+  @spec pixel_canvas_line(pixel_canvas(), coord(), coord(), coord(), coord(), attr()) :: :ok
+  def pixel_canvas_line(_canvas, _x0, _y0, _x1, _y1, _color),
+    do: :erlang.nif_error(:nif_not_loaded)
+
+  @doc """
+  Fills a `w` x `h` pixel rectangle starting at `{x, y}`, clipped to the canvas.
+  """
+  @spec pixel_canvas_fill(pixel_canvas(), coord(), coord(), integer(), integer(), attr()) :: :ok
+  def pixel_canvas_fill(_canvas, _x, _y, _w, _h, _color), do: :erlang.nif_error(:nif_not_loaded)
+
+  @doc """
+  Plots a list of numeric samples spread across the canvas width.
+
+  Values are scaled so that `lo` maps to the bottom row and `hi` to the top row.
+  `style` is `0` for points, `1` for a connected line, or `2` for a filled area.
+  """
+  @spec pixel_canvas_series(pixel_canvas(), [number()], number(), number(), attr(), 0 | 1 | 2) ::
+          :ok
+  def pixel_canvas_series(_canvas, _values, _lo, _hi, _color, _style),
+    do: :erlang.nif_error(:nif_not_loaded)
+
+  @doc """
+  Rasterizes the canvas into the back buffer with its top-left cell at `{x, y}`.
+
+  Unlit cells are written as spaces using `bg`.
+  """
+  @spec pixel_canvas_draw(pixel_canvas(), coord(), coord(), attr()) :: result()
+  def pixel_canvas_draw(_canvas, _x, _y, _bg), do: :erlang.nif_error(:nif_not_loaded)
 end
@@ -0,0 +1,135 @@
+defmodule Termbox2.PixelCanvas do
+  @moduledoc """
+  Sub-cell pixel canvas backed by a native resource.
+
+  Pixels are plotted natively and the whole canvas is rasterized into the
+  Termbox2 back buffer with a single `draw/4` call, which makes it suitable for
+  live graphs and heatmaps.
+
+  Two modes are supported:
+
+    * `:braille` - 2x4 pixels per cell using braille glyphs
+    * `:half_block` - 1x2 pixels per cell using half-block glyphs, with each
+      pixel keeping its own color
+
+  ## Examples
+
+      {:ok, canvas} = Termbox2.PixelCanvas.new(40, 10)
+      :ok = Termbox2.PixelCanvas.series(canvas, samples, style: :area)
+      :ok = Termbox2.PixelCanvas.draw(canvas, 0, 0)
+  """
+
+  alias Termbox2.Native
+
+  @type attr :: Native.attr()
+  @type mode :: :braille | :half_block
+  @type style :: :points | :line | :area
+  @type t :: %__MODULE__{
+          ref: Native.pixel_canvas(),
+          mode: mode(),
+          cols: pos_integer(),
+          rows: pos_integer(),
+          width: pos_integer(),
+          height: pos_integer()
+        }
+
+  defstruct [:ref, :mode, :cols, :rows, :width, :height]
+
+  @doc """
+  Creates a canvas covering `cols` x `rows` terminal cells.
+
+  Both dimensions must be between 1 and 1024. `width` and `height` in the
+  returned struct are measured in pixels.
+  """
+  @spec new(pos_integer(), pos_integer(), mode()) :: {:ok, t()} | {:error, Native.error_code()}
+  def new(cols, rows, mode \\ :braille) do
+    with {:ok, ref} <- Native.pixel_canvas_new(cols, rows, mode_code(mode)) do
+      {px, py} = pixels_per_cell(mode)
+
+      {:ok,
+       %__MODULE__{
+         ref: ref,
+         mode: mode,
+         cols: cols,
+         rows: rows,
+         width: cols * px,
+         height: rows * py
+       }}
+    end
+  end
+
+  @doc """
+  Turns off every pixel.
+  """
+  @spec clear(t()) :: :ok
+  def clear(%__MODULE__{ref: ref}), do: Native.pixel_canvas_clear(ref)
+
+  @doc """
+  Lights a single pixel. Out-of-bounds pixels are ignored.
+  """
+  @spec point(t(), integer(), integer(), attr()) :: :ok
+  def point(%__MODULE__{ref: ref}, x, y, color \\ 0),
+    do: Native.pixel_canvas_set(ref, x, y, color)
+
+  @doc """
+  Draws a line between `{x0, y0}` and `{x1, y1}`.
+  """
+  @spec line(t(), {integer(), integer()}, {integer(), integer()}, attr()) :: :ok
+  def line(%__MODULE__{ref: ref}, {x0, y0}, {x1, y1}, color \\ 0),
+    do: Native.pixel_canvas_line(ref, x0, y0, x1, y1, color)
+
+  @doc """
+  Fills a `w` x `h` pixel rectangle whose top-left corner is `{x, y}`.
+  """
+  @spec fill(t(), integer(), integer(), integer(), integer(), attr()) :: :ok
+  def fill(%__MODULE__{ref: ref}, x, y, w, h, color \\ 0),
+    do: Native.pixel_canvas_fill(ref, x, y, w, h, color)
+
+  @doc """
+  Plots a whole series of samples in one native call.
+
+  Samples are spread evenly across the canvas width and scaled vertically
+  between `:min` and `:max`.
+
+  Options:
+
+    * `:style` - `:points`, `:line` (default), or `:area`
+    * `:color` - foreground attribute (default `0`)
+    * `:min` - value mapped to the bottom row (defaults to the series minimum)
+    * `:max` - value mapped to the top row (defaults to the series maximum)
+
+  When `:min` and `:max` are equal the series is drawn across the middle row.
+  """
+  @spec series(t(), [number()], keyword()) :: :ok
+  def series(canvas, values, opts \\ [])
+
+  def series(%__MODULE__{}, [], _opts), do: :ok
+
+  def series(%__MODULE__{ref: ref}, values, opts) do
+    style = Keyword.get(opts, :style, :line)
+    color = Keyword.get(opts, :color, 0)
+    lo = Keyword.get_lazy(opts, :min, fn -> Enum.min(values) end)
+    hi = Keyword.get_lazy(opts, :max, fn -> Enum.max(values) end)
+
+    Native.pixel_canvas_series(ref, values, lo, hi, color, style_code(style))
+  end
+
+  @doc """
+  Rasterizes the canvas into the back buffer with its top-left cell at `{x, y}`.
+
+  Cells falling outside the terminal are skipped. Call `Termbox2.Native.present/0`
+  afterwards to show the result.
+  """
+  @spec draw(t(), integer(), integer(), attr()) :: Native.result()
+  def draw(%__MODULE__{ref: ref}, x, y, bg \\ 0), do: Native.pixel_canvas_draw(ref, x, y, bg)
+
+  defp mode_code(:braille), do: 0
+  defp mode_code(:half_block), do: 1
+
+  defp pixels_per_cell(:braille), do: {2, 4}
+  defp pixels_per_cell(:half_block), do: {1, 2}
+
+  defp style_code(:points), do: 0
+  defp style_code(:line), do: 1
+  defp style_code(:area), do: 2
+end
@@ -0,0 +1,285 @@
+defmodule Termbox2.Renderer do
+  @moduledoc """
+  Retained-mode renderer that pushes only changed cells to Termbox2.
+
+  Each `render/2` rasterizes a `Termbox2.View` tree into per-node fragments
+  (`Termbox2.ScreenBuffer` cell maps), compares them against the fragments of
+  the previous frame, and resolves only the positions covered by fragments that
+  changed or moved in the stacking order. A retained index of which fragments
+  cover each position keeps that resolution independent of the frame size. The
+  resulting cells are written with a single `Native.set_cells/1` call. Memoized
+  subtrees whose deps are unchanged reuse the previous fragments as-is, so
+  comparing them is constant time.
+
+  The renderer assumes the back buffer still holds the previous frame. Start
+  from a cleared back buffer, and after `Termbox2.Native.clear/0` or a resize
+  call `invalidate/1` (or `resize/3`) so the next frame is painted in full.
+
+  ## Examples
+
+      renderer = Termbox2.Renderer.new()
+      {:ok, renderer} = Termbox2.Renderer.render(renderer, view(model))
+      :ok = Termbox2.Native.present()
+  """
+
+  alias Termbox2.{Native, ScreenBuffer, View}
+
+  @blank %{glyph: ?\s, fg: 0, bg: 0}
+
+  @type cell :: ScreenBuffer.cell()
+  @type path :: [term()]
+  @type t :: %__MODULE__{
+          width: non_neg_integer(),
+          height: non_neg_integer(),
+          order: [path()],
+          fragments: %{optional(path()) => %{optional({integer(), integer()}) => cell()}},
+          frame: %{optional({integer(), integer()}) => cell()},
+          cover: %{optional({integer(), integer()}) => [path()]},
+          memo: %{optional(term()) => map()}
+        }
+
+  defstruct width: 0, height: 0, order: [], fragments: %{}, frame: %{}, cover: %{}, memo: %{}
+
+  @doc """
+  Creates a renderer sized to the provided dimensions (defaults to current terminal size).
+  """
+  @spec new(non_neg_integer(), non_neg_integer()) :: t()
+  def new(width \\ Native.width(), height \\ Native.height()) do
+    %__MODULE__{width: width, height: height}
+  end
+
+  @doc """
+  Forgets the retained frame so the next `render/2` repaints every non-blank cell.
+  """
+  @spec invalidate(t()) :: t()
+  def invalidate(%__MODULE__{} = renderer) do
+    %{renderer | order: [], fragments: %{}, frame: %{}, cover: %{}, memo: %{}}
+  end
+
+  @doc """
+  Changes the renderer dimensions and invalidates the retained frame.
+  """
+  @spec resize(t(), non_neg_integer(), non_neg_integer()) :: t()
+  def resize(%__MODULE__{} = renderer, width, height) do
+    invalidate(%{renderer | width: width, height: height})
+  end
+
+  @doc """
+  Renders `view` and writes the cells that differ from the previous frame to the back buffer.
+
+  Raises `ArgumentError` if the view uses the same memo key more than once.
+
+  Call `Termbox2.Native.present/0` afterwards to show the result. On error no
+  renderer is returned and part of the batch may already have been written, so
+  keep the previous renderer, call `Termbox2.Native.clear/0` and `invalidate/1`
+  on it before retrying.
+  """
+  @spec render(t(), View.t()) :: {:ok, t()} | {:error, Native.error_code()}
+  def render(%__MODULE__{} = renderer, view) do
+    {changes, next} = diff(renderer, view)
+
+    case Native.set_cells(changes) do
+      :ok -> {:ok, next}
+      {:error, code} -> {:error, code}
+    end
+  end
+
+  @doc """
+  Computes the cells that differ from the previous frame without touching Termbox2.
+
+  Returns the `{x, y, glyph, fg, bg}` changes in the form accepted by
+  `Termbox2.Native.set_cells/1` along with the updated renderer.
+  """
+  @spec diff(t(), View.t()) ::
+          {[{integer(), integer(), non_neg_integer(), Native.attr(), Native.attr()}], t()}
+  def diff(%__MODULE__{} = renderer, view) do
+    {rev_fragments, memo} = collect(view, {0, 0}, [], renderer, [], %{})
+
+    order = rev_fragments |> Enum.reverse() |> Enum.map(&elem(&1, 0))
+    fragments = Map.new(rev_fragments)
+    {dirty, cover} = update_cover(renderer, fragments)
+    dirty = add_moved(dirty, renderer, order, fragments)
+    depth = order |> Enum.with_index() |> Map.new()
+
+    {changes, frame} =
+      Enum.reduce(dirty, {[], renderer.frame}, fn pos, {changes, frame} ->
+        cell = topmost(cover, depth, fragments, pos)
+
+        if cell == Map.get(frame, pos, @blank) do
+          {changes, frame}
+        else
+          {x, y} = pos
+          frame = if cell == @blank, do: Map.delete(frame, pos), else: Map.put(frame, pos, cell)
+          {[{x, y, cell.glyph, cell.fg, cell.bg} | changes], frame}
+        end
+      end)
+
+    next = %{
+      renderer
+      | order: order,
+        fragments: fragments,
+        frame: frame,
+        cover: cover,
+        memo: memo
+    }
+
+    {changes, next}
+  end
+
+  # Walks the view tree, accumulating `{path, cells}` fragments in reverse
+  # paint order (topmost first) and the memo entries seen this frame.
+  defp collect(nil, _offset, _path, _renderer, acc, memo), do: {acc, memo}
+
+  defp collect(nodes, offset, path, renderer, acc, memo) when is_list(nodes) do
+    nodes
+    |> Enum.with_index()
+    |> Enum.reduce({acc, memo}, fn {node, index}, {acc, memo} ->
+      collect(node, offset, [index | path], renderer, acc, memo)
+    end)
+  end
+
+  defp collect({:text, x, y, chars, attrs}, {ox, oy}, path, renderer, acc, memo) do
+    {buffer, _} =
+      Enum.reduce(chars, {blank_buffer(renderer), ox + x}, fn ch, {buffer, cx} ->
+        {ScreenBuffer.put(buffer, cx, oy + y, ch, fg: attrs.fg, bg: attrs.bg), cx + 1}
+      end)
+
+    {[{path, buffer.cells} | acc], memo}
+  end
+
+  defp collect({:box, x, y, w, h, attrs, children}, {ox, oy}, path, renderer, acc, memo) do
+    buffer = draw_box(blank_buffer(renderer), ox + x, oy + y, w, h, attrs)
+    acc = [{path, buffer.cells} | acc]
+    collect(children, {ox + x, oy + y}, [:children | path], renderer, acc, memo)
+  end
+
+  defp collect({:memo, key, deps, fun}, offset, _path, renderer, acc, memo) do
+    entry =
+      case Map.get(renderer.memo, key) do
+        %{deps: ^deps, offset: ^offset} = cached ->
+          cached
+
+        _ ->
+          {fragments, inner} = collect(fun.(), offset, [{:memo, key}], renderer, [], %{})
+          %{deps: deps, offset: offset, fragments: fragments, inner: inner}
+      end
+
+    memo =
+      Enum.reduce([{key, entry} | Map.to_list(entry.inner)], memo, fn {key, entry}, memo ->
+        if Map.has_key?(memo, key) do
+          raise ArgumentError, "duplicate memo key in view: #{inspect(key)}"
+        end
+
+        Map.put(memo, key, entry)
+      end)
+
+    {entry.fragments ++ acc, memo}
+  end
+
+  # Positions covered by added, removed, or changed fragments, along with the
+  # coverage index updated for exactly those fragments.
+  defp update_cover(%__MODULE__{} = renderer, fragments) do
+    previous = renderer.fragments
+
+    acc =
+      Enum.reduce(fragments, {MapSet.new(), renderer.cover}, fn {path, cells}, acc ->
+        case Map.fetch(previous, path) do
+          {:ok, ^cells} -> acc
+          {:ok, old} -> acc |> uncover(path, old) |> cover(path, cells)
+          :error -> cover(acc, path, cells)
+        end
+      end)
+
+    Enum.reduce(previous, acc, fn {path, cells}, acc ->
+      if Map.has_key?(fragments, path), do: acc, else: uncover(acc, path, cells)
+    end)
+  end
+
+  defp cover({dirty, index}, path, cells) do
+    Enum.reduce(Map.keys(cells), {dirty, index}, fn pos, {dirty, index} ->
+      {MapSet.put(dirty, pos), Map.update(index, pos, [path], &[path | &1])}
+    end)
+  end
+
+  defp uncover({dirty, index}, path, cells) do
+    Enum.reduce(Map.keys(cells), {dirty, index}, fn pos, {dirty, index} ->
+      index =
+        case Map.fetch!(index, pos) -- [path] do
+          [] -> Map.delete(index, pos)
+          paths -> Map.put(index, pos, paths)
+        end
+
+      {MapSet.put(dirty, pos), index}
+    end)
+  end
+
+  # A fragment kept from the previous frame can only change which cell wins
+  # where it overlaps another fragment whose relative order changed. Comparing
+  # the two orders restricted to common paths slot by slot finds at least one
+  # side of every such pair, so only those fragments are rechecked.
+  defp add_moved(dirty, %__MODULE__{} = renderer, order, fragments) do
+    old_order = Enum.filter(renderer.order, &Map.has_key?(fragments, &1))
+    new_order = Enum.filter(order, &Map.has_key?(renderer.fragments, &1))
+
+    old_order
+    |> Enum.zip(new_order)
+    |> Enum.reduce(dirty, fn
+      {path, path}, acc -> acc
+      {_old, path}, acc -> Enum.reduce(Map.keys(fragments[path]), acc, &MapSet.put(&2, &1))
+    end)
+  end
+
+  defp topmost(cover, depth, fragments, pos) do
+    case Map.get(cover, pos, []) do
+      [] ->
+        @blank
+
+      paths ->
+        path = Enum.max_by(paths, &Map.fetch!(depth, &1))
+        Map.fetch!(fragments[path], pos)
+    end
+  end
+
+  defp blank_buffer(%__MODULE__{width: width, height: height}),
+    do: ScreenBuffer.new(width, height)
+
+  defp draw_box(buffer, _x, _y, w, h, _attrs) when w <= 0 or h <= 0, do: buffer
+
+  defp draw_box(buffer, x, y, w, h, attrs) do
+    right = x + w - 1
+    bottom = y + h - 1
+
+    buffer
+    |> maybe_fill(x, y, right, bottom, attrs)
+    |> maybe_border(x, y, right, bottom, attrs)
+  end
+
+  defp maybe_fill(buffer, x, y, right, bottom, %{fill?: true} = attrs) do
+    for cy <- y..bottom, cx <- x..right, reduce: buffer do
+      acc -> put_attr(acc, cx, cy, ?\s, attrs)
+    end
+  end
+
+  defp maybe_fill(buffer, _x, _y, _right, _bottom, _attrs), do: buffer
+
+  defp maybe_border(buffer, x, y, right, bottom, %{border?: true} = attrs) do
+    buffer =
+      for cx <- x..right, cy <- Enum.uniq([y, bottom]), reduce: buffer do
+        acc -> put_attr(acc, cx, cy, if(cx == x or cx == right, do: ?+, else: ?-), attrs)
+      end
+
+    if bottom - y > 1 do
+      for cy <- (y + 1)..(bottom - 1), cx <- Enum.uniq([x, right]), reduce: buffer do
+        acc -> put_attr(acc, cx, cy, ?|, attrs)
+      end
+    else
+      buffer
+    end
+  end
+
+  defp maybe_border(buffer, _x, _y, _right, _bottom, _attrs), do: buffer
+
+  defp put_attr(buffer, x, y, glyph, attrs) do
+    ScreenBuffer.put(buffer, x, y, glyph, fg: attrs.fg, bg: attrs.bg)
+  end
+end
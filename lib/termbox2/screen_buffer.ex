@@ -52,16 +52,13 @@ defmodule Termbox2.ScreenBuffer do
   end
 
   @doc """
-  Flushes the buffer to Termbox2 by setting each recorded cell via the NIF.
+  Flushes the buffer to Termbox2 by sending every recorded cell in a single NIF call.
   """
   @spec blit(t()) :: :ok | {:error, Native.error_code()}
   def blit(%__MODULE__{} = buffer) do
-    Enum.reduce_while(buffer.cells, :ok, fn {{x, y}, %{glyph: glyph, fg: fg, bg: bg}}, :ok ->
-      case Native.set_cell(x, y, glyph, fg, bg) do
-        :ok -> {:cont, :ok}
-        {:error, code} -> {:halt, {:error, code}}
-      end
-    end)
+    buffer.cells
+    |> Enum.map(fn {{x, y}, %{glyph: glyph, fg: fg, bg: bg}} -> {x, y, glyph, fg, bg} end)
+    |> Native.set_cells()
   end
 
   defp maybe_adjust(%__MODULE__{} = buffer, x, y, true) do
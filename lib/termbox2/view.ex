@@ -0,0 +1,77 @@
+defmodule Termbox2.View do
+  @moduledoc """
+  Constructors for the view trees rendered by `Termbox2.Renderer`.
+
+  A view is a node or a (possibly nested) list of nodes. Coordinates of a
+  box's children are relative to the box's top-left corner; children are not
+  clipped to the box.
+
+  Wrap subtrees that are expensive to build or rarely change in `memo/3` so the
+  renderer can reuse their output while `deps` stay the same.
+
+  ## Examples
+
+      import Termbox2.View
+
+      box(0, 0, 20, 3, [fg: 2], [
+        text(2, 1, status),
+        memo(:legend, [], fn -> text(12, 1, "q: quit") end)
+      ])
+  """
+
+  alias Termbox2.Native
+
+  @type attr :: Native.attr()
+  @type text_node :: {:text, integer(), integer(), [non_neg_integer()], %{fg: attr(), bg: attr()}}
+  @type box_node ::
+          {:box, integer(), integer(), non_neg_integer(), non_neg_integer(),
+           %{fg: attr(), bg: attr(), border?: boolean(), fill?: boolean()}, t()}
+  @type memo_node :: {:memo, term(), term(), (-> t())}
+  @type t :: text_node() | box_node() | memo_node() | [t()] | nil
+
+  @doc """
+  Places a string at `{x, y}`, one codepoint per cell.
+
+  Options:
+
+    * `:fg` - foreground attribute (default `0`)
+    * `:bg` - background attribute (default `0`)
+  """
+  @spec text(integer(), integer(), String.t() | charlist(), keyword()) :: text_node()
+  def text(x, y, content, opts \\ []) do
+    chars = if is_binary(content), do: String.to_charlist(content), else: content
+    {:text, x, y, chars, %{fg: Keyword.get(opts, :fg, 0), bg: Keyword.get(opts, :bg, 0)}}
+  end
+
+  @doc """
+  Draws a `width` x `height` box at `{x, y}` containing `children`.
+
+  Options:
+
+    * `:fg` - foreground attribute of the border (default `0`)
+    * `:bg` - background attribute of the border and fill (default `0`)
+    * `:border?` - draw a `+`, `-`, `|` border (default `true`)
+    * `:fill?` - paint the interior with blanks so lower layers are hidden (default `false`)
+  """
+  @spec box(integer(), integer(), non_neg_integer(), non_neg_integer(), keyword(), t()) ::
+          box_node()
+  def box(x, y, width, height, opts \\ [], children \\ []) do
+    attrs = %{
+      fg: Keyword.get(opts, :fg, 0),
+      bg: Keyword.get(opts, :bg, 0),
+      border?: Keyword.get(opts, :border?, true),
+      fill?: Keyword.get(opts, :fill?, false)
+    }
+
+    {:box, x, y, width, height, attrs, children}
+  end
+
+  @doc """
+  Memoizes the subtree returned by `fun`.
+
+  `key` must be unique within the view. The renderer calls `fun` again only
+  when `deps` differ from the previous frame or the subtree moved.
+  """
+  @spec memo(term(), term(), (-> t())) :: memo_node()
+  def memo(key, deps, fun) when is_function(fun, 0), do: {:memo, key, deps, fun}
+end
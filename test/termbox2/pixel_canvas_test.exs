@@ -0,0 +1,52 @@
+defmodule Termbox2.PixelCanvasTest do
+  use ExUnit.Case, async: true
+
+  alias Termbox2.PixelCanvas
+
+  test "braille canvas has 2x4 pixels per cell" do
+    assert {:ok, canvas} = PixelCanvas.new(10, 3)
+    assert %PixelCanvas{mode: :braille, cols: 10, rows: 3, width: 20, height: 12} = canvas
+  end
+
+  test "half-block canvas has 1x2 pixels per cell" do
+    assert {:ok, canvas} = PixelCanvas.new(10, 3, :half_block)
+    assert %PixelCanvas{mode: :half_block, width: 10, height: 6} = canvas
+  end
+
+  test "empty series is a no-op" do
+    {:ok, canvas} = PixelCanvas.new(4, 2)
+
+    assert PixelCanvas.series(canvas, []) == :ok
+  end
+
+  test "series accepts every style, including a constant series" do
+    {:ok, canvas} = PixelCanvas.new(4, 2, :half_block)
+
+    for style <- [:points, :line, :area] do
+      assert PixelCanvas.series(canvas, [1, 2.5, 0, 4], style: style, color: 2) == :ok
+      assert PixelCanvas.series(canvas, [3, 3, 3], style: style) == :ok
+    end
+  end
+
+  test "plotting outside the canvas is ignored" do
+    {:ok, canvas} = PixelCanvas.new(2, 1)
+
+    assert PixelCanvas.point(canvas, -1, 100) == :ok
+    assert PixelCanvas.line(canvas, {-10, -10}, {10, 10}) == :ok
+    assert PixelCanvas.fill(canvas, -5, -5, 100, 100) == :ok
+    assert PixelCanvas.clear(canvas) == :ok
+  end
+
+  test "out-of-range sizes raise" do
+    assert_raise ArgumentError, fn -> PixelCanvas.new(0, 1) end
+    assert_raise ArgumentError, fn -> PixelCanvas.new(1, -1) end
+    assert_raise ArgumentError, fn -> PixelCanvas.new(1025, 1) end
+  end
+
+  test "unknown mode or style raises" do
+    assert_raise FunctionClauseError, fn -> PixelCanvas.new(1, 1, :sixel) end
+
+    {:ok, canvas} = PixelCanvas.new(1, 1)
+    assert_raise FunctionClauseError, fn -> PixelCanvas.series(canvas, [1], style: :bars) end
+  end
+end
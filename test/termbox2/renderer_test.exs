@@ -0,0 +1,80 @@
+defmodule Termbox2.RendererTest do
+  use ExUnit.Case, async: true
+
+  alias Termbox2.{Renderer, View}
+
+  defp render(renderer, view) do
+    {changes, renderer} = Renderer.diff(renderer, view)
+    {Enum.sort(changes), renderer}
+  end
+
+  test "first frame emits every non-blank cell" do
+    {changes, _} = render(Renderer.new(10, 2), View.text(1, 0, "hi", fg: 3))
+
+    assert changes == [{1, 0, ?h, 3, 0}, {2, 0, ?i, 3, 0}]
+  end
+
+  test "unchanged memo produces no changes and is not re-evaluated" do
+    parent = self()
+
+    view = fn deps ->
+      View.memo(:label, deps, fn ->
+        send(parent, :built)
+        View.text(0, 0, "abc")
+      end)
+    end
+
+    {_, renderer} = render(Renderer.new(10, 2), view.(1))
+    assert_received :built
+
+    {changes, renderer} = render(renderer, view.(1))
+    assert changes == []
+    refute_received :built
+
+    {changes, _} = render(renderer, view.(2))
+    assert changes == []
+    assert_received :built
+  end
+
+  test "removed node blanks its cells" do
+    {_, renderer} = render(Renderer.new(10, 2), [View.text(0, 0, "ab"), View.text(0, 1, "z")])
+    {changes, renderer} = render(renderer, [View.text(0, 0, "ab")])
+
+    assert changes == [{0, 1, ?\s, 0, 0}]
+    assert renderer.cover |> Map.keys() |> Enum.sort() == [{0, 0}, {1, 0}]
+  end
+
+  test "reordered overlap repaints the cell with the new topmost fragment" do
+    a = View.memo(:a, [], fn -> View.text(0, 0, "AA") end)
+    b = View.memo(:b, [], fn -> View.text(1, 0, "B") end)
+
+    {changes, renderer} = render(Renderer.new(10, 2), [a, b])
+    assert changes == [{0, 0, ?A, 0, 0}, {1, 0, ?B, 0, 0}]
+
+    {changes, _} = render(renderer, [b, a])
+    assert changes == [{1, 0, ?A, 0, 0}]
+  end
+
+  test "changed text only emits the cells that differ" do
+    {_, renderer} = render(Renderer.new(10, 2), View.text(0, 0, "cat"))
+    {changes, _} = render(renderer, View.text(0, 0, "cut"))
+
+    assert changes == [{1, 0, ?u, 0, 0}]
+  end
+
+  test "duplicate memo keys raise" do
+    a = View.memo(:same, [], fn -> View.text(0, 0, "a") end)
+    inner = View.memo(:same, [], fn -> View.text(0, 1, "b") end)
+    nested = View.memo(:outer, [], fn -> inner end)
+
+    assert_raise ArgumentError, fn -> render(Renderer.new(10, 2), [a, a]) end
+    assert_raise ArgumentError, fn -> render(Renderer.new(10, 2), [a, nested]) end
+  end
+
+  test "box children are positioned relative to the box" do
+    view = View.box(2, 0, 3, 3, [border?: false], [View.text(1, 1, "x")])
+    {changes, _} = render(Renderer.new(10, 5), view)
+
+    assert changes == [{3, 1, ?x, 0, 0}]
+  end
+end